@@ -0,0 +1,114 @@
+#!/bin/sh
+# Runs identical workloads through mysh, bash and dash (when installed) and
+# reports the median wall time per run with a 95% confidence interval.
+#
+# usage: bench/compare_shells.sh [-s MYSH] [-n RUNS] [-w WARMUP] [-l LINES]
+#                                [-c CPU] [-o CSV]
+#
+# Each workload is a script fed on stdin, so it only uses syntax that all
+# three shells accept. Runs are pinned to one CPU with taskset when it is
+# available. Results are appended to the CSV file for tracking over time.
+
+MYSH=./shell
+RUNS=21
+WARMUP=3
+LINES=200
+CPU=0
+CSV=bench_results.csv
+
+while getopts s:n:w:l:c:o: opt; do
+    case $opt in
+    s) MYSH=$OPTARG ;;
+    n) RUNS=$OPTARG ;;
+    w) WARMUP=$OPTARG ;;
+    l) LINES=$OPTARG ;;
+    c) CPU=$OPTARG ;;
+    o) CSV=$OPTARG ;;
+    *) sed -n '5,6p' "$0"; exit 2 ;;
+    esac
+done
+
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+PIN=""
+if command -v taskset >/dev/null 2>&1; then
+    PIN="taskset -c $CPU"
+fi
+
+# WORKLOADS
+
+repeat() {
+    i=0
+    while [ $i -lt "$LINES" ]; do
+        echo "$1"
+        i=$((i + 1))
+    done
+}
+
+echo "exit" > "$TMP/startup.sh"
+repeat "true" > "$TMP/loop.sh"
+repeat "echo payload | cat" > "$TMP/pipeline.sh"
+{
+    repeat "echo payload > $TMP/redir.out"
+    repeat "cat < $TMP/redir.out > $TMP/redir.copy"
+} > "$TMP/redirect.sh"
+repeat "true &" > "$TMP/fanout.sh"
+
+WORKLOADS="startup loop pipeline redirect fanout"
+
+# MEASUREMENT
+
+now_ns() {
+    date +%s%N
+}
+
+# Prints one wall time in microseconds per measured run.
+measure() {
+    sh_bin=$1
+    script=$2
+    i=0
+    while [ $i -lt "$WARMUP" ]; do
+        $PIN "$sh_bin" < "$script" > /dev/null 2>&1
+        i=$((i + 1))
+    done
+    i=0
+    while [ $i -lt "$RUNS" ]; do
+        t0=$(now_ns)
+        $PIN "$sh_bin" < "$script" > /dev/null 2>&1
+        t1=$(now_ns)
+        echo $(((t1 - t0) / 1000))
+        i=$((i + 1))
+    done
+}
+
+# Reads samples on stdin and prints "median ci_low ci_high mean" in ms. The
+# interval uses the distribution-free order-statistic bounds for the median.
+summarize() {
+    sort -n | awk '
+        { v[NR] = $1; sum += $1 }
+        END {
+            n = NR
+            med = (n % 2) ? v[(n + 1) / 2] : (v[n / 2] + v[n / 2 + 1]) / 2
+            lo = int(n / 2 - 0.98 * sqrt(n)); if (lo < 1) lo = 1
+            hi = int(n / 2 + 1 + 0.98 * sqrt(n) + 0.999); if (hi > n) hi = n
+            printf "%.3f %.3f %.3f %.3f\n", med / 1000, v[lo] / 1000, v[hi] / 1000, sum / n / 1000
+        }'
+}
+
+SHELLS="mysh"
+command -v bash >/dev/null 2>&1 && SHELLS="$SHELLS bash"
+command -v dash >/dev/null 2>&1 && SHELLS="$SHELLS dash"
+
+[ -f "$CSV" ] || echo "date,shell,workload,lines,runs,median_ms,ci_low_ms,ci_high_ms,mean_ms" > "$CSV"
+STAMP=$(date -u +%Y-%m-%dT%H:%M:%SZ)
+
+printf '%-6s %-9s %10s %21s %10s\n' shell workload median_ms "95% CI" mean_ms
+for w in $WORKLOADS; do
+    for s in $SHELLS; do
+        if [ "$s" = mysh ]; then bin=$MYSH; else bin=$(command -v "$s"); fi
+        set -- $(measure "$bin" "$TMP/$w.sh" | summarize)
+        printf '%-6s %-9s %10s %10s-%-10s %10s\n' "$s" "$w" "$1" "$2" "$3" "$4"
+        echo "$STAMP,$s,$w,$LINES,$RUNS,$1,$2,$3,$4" >> "$CSV"
+    done
+done
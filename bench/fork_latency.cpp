@@ -0,0 +1,100 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+using namespace std;
+
+// Measures fork() + _exit() + waitpid() latency against the size of the
+// parent's resident memory, with that memory either on the ordinary heap or
+// in an mmap'd region marked MADV_DONTFORK (as the shell's large_pool is).
+//
+// usage: fork_latency [MAX_MB] [ROUNDS]
+
+double fork_latency_us(int rounds)
+{
+    vector<double> samples;
+    for (int i = 0; i < rounds; i++)
+    {
+        auto t0 = chrono::steady_clock::now();
+        pid_t pid = fork();
+        if (pid == 0)
+            _exit(0);
+        if (pid < 0)
+        {
+            perror("fork");
+            exit(1);
+        }
+        waitpid(pid, nullptr, 0);
+        samples.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count());
+    }
+    sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+// Allocates and touches mb megabytes, either from malloc or from a
+// MADV_DONTFORK mapping.
+void *grow(size_t mb, bool dontfork)
+{
+    size_t len = mb << 20;
+    if (len == 0)
+        return nullptr;
+
+    void *p;
+    if (dontfork)
+    {
+        p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+            return nullptr;
+        madvise(p, len, MADV_DONTFORK);
+    }
+    else
+    {
+        p = malloc(len);
+        if (!p)
+            return nullptr;
+    }
+    memset(p, 1, len);
+    return p;
+}
+
+void release(void *p, size_t mb, bool dontfork)
+{
+    if (!p)
+        return;
+    if (dontfork)
+        munmap(p, mb << 20);
+    else
+        free(p);
+}
+
+int main(int argc, char **argv)
+{
+    size_t max_mb = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1024;
+    int rounds = argc > 2 ? atoi(argv[2]) : 50;
+
+    cout << "heap_mb\theap_us\tdontfork_us\n";
+    for (size_t mb = 0; mb <= max_mb; mb = mb ? mb * 2 : 16)
+    {
+        double us[2];
+        for (int mode = 0; mode < 2; mode++)
+        {
+            void *p = grow(mb, mode == 1);
+            if (mb && !p)
+            {
+                cerr << "Error: cannot allocate " << mb << " MB\n";
+                return 1;
+            }
+            us[mode] = fork_latency_us(rounds);
+            release(p, mb, mode == 1);
+        }
+        cout << mb << "\t" << (long)us[0] << "\t" << (long)us[1] << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+// Emits a synthetic mysh workload. Every command only uses syntax that the
+// shell's main() understands: builtins, simple commands, pipelines, < and >
+// redirections and trailing &.
+//
+// With --record the output is a session log that `shell --replay LOG
+// --speed 0` runs back to back, reporting throughput and tail latency.
+
+struct Mix
+{
+    int builtin = 10;
+    int simple = 40;
+    int pipeline = 20;
+    int redirect = 15;
+    int background = 5;
+    int longargs = 10;
+};
+
+// MIX PARSING
+
+bool parse_mix(const string &spec, Mix &mix)
+{
+    size_t pos = 0;
+    while (pos < spec.size())
+    {
+        size_t comma = spec.find(',', pos);
+        if (comma == string::npos)
+            comma = spec.size();
+        string item = spec.substr(pos, comma - pos);
+        pos = comma + 1;
+
+        size_t eq = item.find('=');
+        if (eq == string::npos)
+            return false;
+        string key = item.substr(0, eq);
+        int w = atoi(item.c_str() + eq + 1);
+
+        if (key == "builtin")
+            mix.builtin = w;
+        else if (key == "simple")
+            mix.simple = w;
+        else if (key == "pipe")
+            mix.pipeline = w;
+        else if (key == "redir")
+            mix.redirect = w;
+        else if (key == "bg")
+            mix.background = w;
+        else if (key == "longargs")
+            mix.longargs = w;
+        else
+            return false;
+    }
+    return true;
+}
+
+// COMMAND GENERATION
+
+struct Generator
+{
+    mt19937_64 rng;
+    string scratch;
+    int pipe_depth;
+    int max_args;
+
+    int pick(int n)
+    {
+        return uniform_int_distribution<int>(0, n - 1)(rng);
+    }
+
+    string word()
+    {
+        static const char *words[] = {"alpha", "beta", "gamma", "delta",
+                                      "epsilon", "zeta", "eta", "theta"};
+        return words[pick(8)];
+    }
+
+    string builtin()
+    {
+        static const char *dirs[] = {"/", "/tmp", "/usr", "/etc"};
+        return string("cd ") + dirs[pick(4)];
+    }
+
+    string simple()
+    {
+        switch (pick(4))
+        {
+        case 0:
+            return "true";
+        case 1:
+            return "echo " + word() + " " + word();
+        case 2:
+            return "ls /";
+        default:
+            return "uname";
+        }
+    }
+
+    string filter()
+    {
+        static const char *filters[] = {"cat", "wc -l", "sort", "head -n 5",
+                                        "tr a-z A-Z"};
+        return filters[pick(5)];
+    }
+
+    string pipeline()
+    {
+        int depth = 2 + (pipe_depth > 2 ? pick(pipe_depth - 1) : 0);
+        string cmd = pick(2) ? "ls /usr/bin" : "cat /etc/passwd";
+        for (int i = 1; i < depth; i++)
+            cmd += " | " + filter();
+        return cmd;
+    }
+
+    string redirect()
+    {
+        string out = scratch + "/mysh_gen_" + to_string(pick(4)) + ".txt";
+        switch (pick(3))
+        {
+        case 0:
+            return "echo " + word() + " > " + out;
+        case 1:
+            return "wc -l < /etc/passwd";
+        default:
+            return "sort < /etc/passwd > " + out;
+        }
+    }
+
+    string background()
+    {
+        return pick(2) ? "true &" : "echo " + word() + " &";
+    }
+
+    string longargs()
+    {
+        int n = 1 + pick(max_args);
+        string cmd = "echo";
+        for (int i = 0; i < n; i++)
+            cmd += " " + word() + to_string(i);
+        return cmd;
+    }
+
+    string next(const Mix &mix)
+    {
+        int total = mix.builtin + mix.simple + mix.pipeline + mix.redirect +
+                    mix.background + mix.longargs;
+        int r = pick(total > 0 ? total : 1);
+
+        if ((r -= mix.builtin) < 0)
+            return builtin();
+        if ((r -= mix.simple) < 0)
+            return simple();
+        if ((r -= mix.pipeline) < 0)
+            return pipeline();
+        if ((r -= mix.redirect) < 0)
+            return redirect();
+        if ((r -= mix.background) < 0)
+            return background();
+        return longargs();
+    }
+};
+
+void usage()
+{
+    cerr << "usage: gen_workload [--seed N] [--count N] [--pipe-depth N]\n"
+         << "                    [--max-args N] [--scratch DIR] [--record]\n"
+         << "                    [--mix builtin=W,simple=W,pipe=W,redir=W,bg=W,longargs=W]\n";
+}
+
+int main(int argc, char **argv)
+{
+    ios::sync_with_stdio(false);
+
+    unsigned long long seed = 1;
+    long count = 1000;
+    bool record = false;
+    Mix mix;
+    Generator gen;
+    gen.scratch = "/tmp";
+    gen.pipe_depth = 2;
+    gen.max_args = 200;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--seed" && i + 1 < argc)
+        {
+            seed = strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--count" && i + 1 < argc)
+        {
+            count = atol(argv[++i]);
+        }
+        else if (arg == "--pipe-depth" && i + 1 < argc)
+        {
+            gen.pipe_depth = max(2, atoi(argv[++i]));
+        }
+        else if (arg == "--max-args" && i + 1 < argc)
+        {
+            gen.max_args = max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--scratch" && i + 1 < argc)
+        {
+            gen.scratch = argv[++i];
+        }
+        else if (arg == "--record")
+        {
+            record = true;
+        }
+        else if (arg == "--mix" && i + 1 < argc)
+        {
+            if (!parse_mix(argv[++i], mix))
+            {
+                cerr << "Error: bad mix specification\n";
+                return 2;
+            }
+        }
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    gen.rng.seed(seed);
+
+    for (long i = 0; i < count; i++)
+    {
+        string cmd = gen.next(mix);
+        if (record)
+            cout << "L\t0\t\t" << cmd << "\n";
+        else
+            cout << cmd << "\n";
+    }
+
+    return 0;
+}
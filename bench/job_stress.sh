@@ -0,0 +1,22 @@
+#!/bin/sh
+# Launches JOBS background jobs from one shell, one "true &" line each, and
+# waits for all of them. Reports the job counts before and after the wait,
+# the job table's memory and the overall launch rate.
+# usage: bench/job_stress.sh [SHELL] [JOBS]
+
+SHELL_BIN=${1:-./shell}
+JOBS=${2:-100000}
+
+t0=$(date +%s%N)
+{
+    yes 'true &' | head -n "$JOBS"
+    echo 'jobs -s'
+    echo 'wait'
+    echo 'jobs -s'
+    echo 'memstat'
+} | "$SHELL_BIN" | grep -E 'running,|^job table|^process:' | sed 's/^\(mysh> \)*//'
+t1=$(date +%s%N)
+
+ms=$(((t1 - t0) / 1000000))
+[ "$ms" -gt 0 ] || ms=1
+echo "$JOBS jobs in $ms ms, $((JOBS * 1000 / ms)) jobs/s"
@@ -0,0 +1,13 @@
+#!/bin/sh
+# Reports background launch rate as the launch thread count grows.
+# usage: bench/launch_rate.sh [SHELL] [JOBS] [MAX_THREADS]
+
+SHELL_BIN=${1:-./shell}
+JOBS=${2:-2000}
+MAX=${3:-8}
+
+t=1
+while [ "$t" -le "$MAX" ]; do
+    printf 'launchers %s\nbatch %s true\n' "$t" "$JOBS" | "$SHELL_BIN" | grep -o '\[batch:.*'
+    t=$((t * 2))
+done
@@ -0,0 +1,27 @@
+#!/bin/sh
+# Runs a few synthetic workload mixes through mysh and prints throughput
+# and tail latency for each. Usage: bench/workload_bench.sh [SHELL] [COUNT]
+
+SHELL_BIN=${1:-./shell}
+COUNT=${2:-2000}
+GEN=${GEN:-./bench/gen_workload}
+SEED=${SEED:-1}
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+
+run_mix() {
+    name=$1
+    shift
+    "$GEN" --seed "$SEED" --count "$COUNT" --scratch "$TMP" --record "$@" > "$TMP/$name.log"
+    printf '%-12s ' "$name"
+    "$SHELL_BIN" --replay "$TMP/$name.log" --speed 0 --report "$TMP/$name.tsv" \
+        2>&1 >/dev/null | grep '^\[replay'
+}
+
+run_mix balanced
+run_mix builtins   --mix builtin=80,simple=20,pipe=0,redir=0,bg=0,longargs=0
+run_mix simple     --mix builtin=0,simple=100,pipe=0,redir=0,bg=0,longargs=0
+run_mix pipelines  --mix builtin=0,simple=0,pipe=100,redir=0,bg=0,longargs=0
+run_mix redirects  --mix builtin=0,simple=0,pipe=0,redir=100,bg=0,longargs=0
+run_mix background --mix builtin=0,simple=0,pipe=0,redir=0,bg=100,longargs=0
+run_mix longargs   --mix builtin=0,simple=0,pipe=0,redir=0,bg=0,longargs=100
@@ -0,0 +1,21 @@
+#!/bin/sh
+# Defers a background job under admission limits nothing can meet, turns
+# admission off and checks that the job still runs and the shell exits.
+# usage: tests/admission_off.sh [SHELL]
+
+SHELL_BIN=${1:-./shell}
+OUT=$(mktemp)
+rm -f "$OUT"
+trap 'rm -f "$OUT"' EXIT
+
+printf 'admit on cpu=-1 memory=-1 io=-1 load=-1\necho ran > %s &\nadmit off\nwait\n' "$OUT" |
+    timeout 10 "$SHELL_BIN" > /dev/null 2>&1
+if [ $? -ne 0 ]; then
+    echo "FAIL: shell did not exit after admit off"
+    exit 1
+fi
+if [ "$(cat "$OUT" 2>/dev/null)" != ran ]; then
+    echo "FAIL: deferred job did not run"
+    exit 1
+fi
+echo "PASS: deferred jobs start after admit off"
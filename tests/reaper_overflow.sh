@@ -0,0 +1,19 @@
+#!/bin/sh
+# Starts more children in one batch than the reaper's ring holds, before
+# any of them is adopted, and checks that wait sees every exit.
+# usage: tests/reaper_overflow.sh [SHELL] [JOBS]
+
+SHELL_BIN=${1:-./shell}
+JOBS=${2:-3000}
+
+out=$(printf 'batch %s true\nwait\njobs -s\n' "$JOBS" | timeout 60 "$SHELL_BIN" 2>&1)
+if [ $? -ne 0 ]; then
+    echo "FAIL: wait did not return"
+    exit 1
+fi
+if ! echo "$out" | grep -q '0 running, 0 done, 0 processes'; then
+    echo "FAIL: jobs left after wait:"
+    echo "$out" | grep 'running,'
+    exit 1
+fi
+echo "PASS: $JOBS exits routed"
@@ -0,0 +1,31 @@
+#!/bin/sh
+# Records a session that handles credentials and checks that none of them
+# reach the session log.
+# usage: tests/record_redaction.sh [SHELL]
+
+SHELL_BIN=${1:-./shell}
+LOG=$(mktemp)
+trap 'rm -f "$LOG"' EXIT
+
+printf '%s\n' \
+    'DATABASE_URL=postgres://u:hunter2@db/x' \
+    'WEBHOOK=https://h.example/hook?user=me&token=tok3n&x=1' \
+    'API_TOKEN=sekrit' \
+    'DB_PASSWORD="pw 1" echo done; true' \
+    'echo done' |
+    env -i PATH=/usr/bin:/bin "$SHELL_BIN" --record "$LOG" > /dev/null 2>&1
+
+status=0
+for secret in hunter2 tok3n sekrit 'pw 1'; do
+    if grep -q "$secret" "$LOG"; then
+        echo "FAIL: $secret in the session log:"
+        grep "$secret" "$LOG"
+        status=1
+    fi
+done
+if ! grep -q '^E	+	DATABASE_URL=postgres://\*\*\*@db/x$' "$LOG"; then
+    echo "FAIL: DATABASE_URL not recorded with its userinfo masked"
+    status=1
+fi
+[ $status -eq 0 ] && echo "PASS: credentials kept out of the session log"
+exit $status